@@ -0,0 +1,93 @@
+class Memory;
+struct Segment;
+
+//number of entries the table of labels starts with (a power of 2)
+#define LABELTABLESIZE 256
+//bytes of code collected before they are stored in memory at once
+#define RUNSIZE 4096
+
+//the operands of each kind of statement
+#define NOCODE 0      //blank, comment, labels or .pos/.align: no bytes
+#define NOOPERANDS 1  //halt, nop, ret
+#define REGREG 2      //rrmovq, cmovXX, OPq: rA, rB
+#define IMMREG 3      //irmovq: V, rB
+#define REGMEM 4      //rmmovq: rA, D(rB)
+#define MEMREG 5      //mrmovq: D(rB), rA
+#define DEST 6        //jXX, call: Dest
+#define ONEREG 7      //pushq, popq: rA
+#define QUAD 8        //.quad: V
+
+//a line of a .ys file, parsed by the first pass. An operand that is
+//a label is found by name in the second pass, when every label is known.
+struct Statement
+{
+   const char * line;    //the text of the line (in the copy of the source)
+   int32_t lineLength;
+   int32_t lineNumber;
+   int32_t address;      //address of the first byte (or of the labels)
+   int32_t length;       //number of bytes
+   uint8_t format;
+   uint8_t icode;
+   uint8_t ifun;
+   uint8_t rA;
+   uint8_t rB;
+   bool listed;          //true if the .yo listing gives the line an address
+   const char * label;   //the label of the operand, or NULL if it's value
+   int32_t labelLength;
+   uint64_t value;       //V, D or Dest
+};
+
+//a label of a .ys file and its address
+struct Label
+{
+   const char * name;    //in the copy of the source
+   int32_t length;
+   int32_t address;
+};
+
+//assembles y86-64 source (.ys) directly into Memory. The first pass
+//parses every line and gives the labels their addresses; the second
+//encodes the instructions and data and stores each run of consecutive
+//bytes in memory with one putBytes. The listing of the program can
+//be written as a .yo file that the Loader accepts.
+class Assembler
+{
+   private:
+      Memory * mem;
+      std::ostream * out;       //errors are output here
+      char * source;            //copy of the .ys file, which the statements
+      int32_t sourceSize;       //and labels point into
+      Statement * statements;   //one per line
+      int32_t numStatements;
+      int32_t maxStatements;    //capacity of statements
+      Label * labels;           //hash table of the labels keyed by name
+      int32_t tableSize;        //number of entries (a power of 2)
+      int32_t numLabels;
+      Segment * segments;       //runs of bytes stored, in the order stored
+      int32_t numSegments;
+      int32_t maxSegments;
+      bool inComment;           //true inside a /* */ comment
+      const char * error;       //why the line being parsed is wrong
+      uint8_t run[RUNSIZE];     //bytes not yet stored in memory
+      int32_t runAddress;
+      int32_t runLength;
+      bool parse(Statement & stmt, const char * p, const char * end);
+      bool parseRegister(const char * & p, const char * end, uint8_t & reg);
+      bool parseValue(const char * & p, const char * end, Statement & stmt);
+      bool parseNumber(const char * & p, const char * end, uint64_t & value);
+      bool parseMemory(const char * & p, const char * end, Statement & stmt);
+      bool expect(const char * & p, const char * end, char c);
+      const char * skip(const char * p, const char * end);
+      int32_t identifierLength(const char * p, const char * end);
+      Label * find(const char * name, int32_t length);
+      void grow();
+      void encode(Statement & stmt);
+      void flush();
+      void reportError(Statement & stmt);
+   public:
+      Assembler(Memory * mem, std::ostream & out);
+      ~Assembler();
+      bool assemble(const char * buffer, int32_t size);
+      Segment * getSegments(int32_t & count);
+      bool writeListing(char * name);
+};
@@ -0,0 +1,98 @@
+class Functional;
+
+//largest number of instructions in a block
+#define MAXBLOCKSIZE 64
+//number of entries the table of blocks starts with (a power of 2)
+#define BLOCKTABLESIZE 256
+//bytes of memory covered by each list of the blocks translated from it
+#define CODECHUNK 64
+//bytes of memory covered by each page of those lists (a multiple of
+//CODECHUNK); the pages are allocated when a block is translated
+#define CODEPAGE 4096
+//exit of a block that has no link (a ret, a halt, or leaving early)
+#define NOLINK -1
+
+struct TranslatedOp;
+
+//executes a translated instruction; returns false if the rest of the
+//block must not be executed (the instruction stopped the machine, or
+//it wrote to the block)
+typedef bool (* OpHandler)(Functional * isa, const TranslatedOp * op);
+
+//an instruction of a block, decoded when the block was translated
+struct TranslatedOp
+{
+   OpHandler handler;
+   uint64_t pc;          //address of the instruction
+   uint64_t valC;
+   uint64_t valP;
+   uint8_t ifun;
+   uint8_t rA;
+   uint8_t rB;
+};
+
+//a y86 basic block: the instructions from pc up to and including the
+//first jXX, call, ret or halt (or up to MAXBLOCKSIZE instructions, or
+//an instruction that can't be translated). links[0] is the block at
+//the fall-through (or jump not taken) exit and links[1] the block at
+//the jump or call target; they are filled in the first time the exit
+//is taken, and cleared if that block is discarded.
+struct Block
+{
+   uint64_t pc;
+   uint64_t end;         //address after the last instruction
+   bool valid;           //false once a byte of the block has been written
+   int32_t numOps;
+   TranslatedOp * ops;
+   Block * links[2];
+   Block ** from;        //blocks with a link to this one (once per link)
+   int32_t numFrom;
+   int32_t maxFrom;      //capacity of from
+};
+
+//the blocks translated from CODECHUNK bytes of memory
+struct CodeChunk
+{
+   Block ** blocks;      //NULL until a block is translated from the chunk
+   int32_t numBlocks;
+   int32_t maxBlocks;    //capacity of blocks
+};
+
+//the blocks translated by the Functional machine, found by the pc of
+//their first instruction. Each block is also listed in the chunks of
+//memory it was translated from, kept for each CODEPAGE bytes of memory
+//that holds code. Memory calls invalidate when it is written, which 
+//discards the blocks in the chunks written that hold the bytes written;
+//they are freed by release, before the next block is executed.
+class BlockCache
+{
+   private:
+      Block ** table;        //hash table of the valid blocks keyed by pc
+      int32_t tableSize;     //number of entries (a power of 2)
+      int32_t numEntries;    //number of entries in use
+      CodeChunk ** codePages;  //per CODEPAGE bytes of memory: its chunks,
+      int32_t numCodePages;    //or NULL if no block is translated from it
+      Block ** discarded;    //blocks not yet freed by release
+      int32_t numDiscarded;
+      int32_t maxDiscarded;  //capacity of discarded
+      uint64_t translated;
+      uint64_t invalidations;
+      Block ** find(uint64_t pc);
+      void grow();
+      void remove(Block * block);
+      void discard(Block * block);
+      void freeBlock(Block * block);
+      CodeChunk * getChunk(uint64_t chunk);
+      void addBlock(Block ** & list, int32_t & num, int32_t & max, Block * block);
+      void removeBlock(Block ** list, int32_t & num, Block * block);
+   public:
+      BlockCache(int32_t memSize);
+      ~BlockCache();
+      Block * lookup(uint64_t pc);
+      Block * insert(uint64_t pc, uint64_t end, TranslatedOp * ops, int32_t numOps);
+      void link(Block * block, int32_t exit, Block * next);
+      void invalidate(int32_t address, int32_t size);
+      void release();
+      uint64_t getTranslated();
+      uint64_t getInvalidations();
+};
@@ -0,0 +1,79 @@
+class Checkpoint;
+
+//number of 2-bit counters in the bimodal and gshare tables (a power of 2)
+#define BIMODALSIZE 4096
+#define GSHARESIZE 4096
+//number of jump outcomes in the global history used by gshare
+#define GSHAREHISTORY 12
+
+//base class of the predictors the fetch stage uses for conditional
+//jumps; unconditional jumps and calls are always predicted taken
+class BranchPredictor
+{
+   private:
+      uint64_t predictions;      //conditional jumps that were resolved
+      uint64_t mispredictions;
+   protected:
+      BranchPredictor();
+      virtual void train(uint64_t pc, bool taken) { }
+   public:
+      virtual ~BranchPredictor() { }
+      static BranchPredictor * create(const char * name);
+      virtual const char * getName() = 0;
+      virtual bool predict(uint64_t pc, uint64_t target) = 0;
+      void update(uint64_t pc, bool taken, bool mispredicted);
+      uint64_t getPredictions();
+      uint64_t getMispredictions();
+      virtual void save(Checkpoint * ckpt);
+      virtual void restore(Checkpoint * ckpt);
+};
+
+//predicts every jump taken (the predictor of the PIPE machine)
+class AlwaysTaken : public BranchPredictor
+{
+   public:
+      const char * getName() { return "taken"; }
+      bool predict(uint64_t pc, uint64_t target) { return true; }
+};
+
+//backward taken, forward not taken: predicts the jumps to lower
+//addresses (loops) taken
+class BTFN : public BranchPredictor
+{
+   public:
+      const char * getName() { return "btfn"; }
+      bool predict(uint64_t pc, uint64_t target) { return target <= pc; }
+};
+
+//a table of 2-bit saturating counters indexed by the pc of the jump
+class Bimodal : public BranchPredictor
+{
+   private:
+      uint8_t counters[BIMODALSIZE];   //0, 1: not taken; 2, 3: taken
+   protected:
+      void train(uint64_t pc, bool taken);
+   public:
+      Bimodal();
+      const char * getName() { return "bimodal"; }
+      bool predict(uint64_t pc, uint64_t target);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+};
+
+//a table of 2-bit saturating counters indexed by the pc of the jump
+//xor-ed with the outcomes of the last GSHAREHISTORY jumps
+class Gshare : public BranchPredictor
+{
+   private:
+      uint8_t counters[GSHARESIZE];
+      uint64_t history;                //1 bits are jumps that were taken
+      uint32_t index(uint64_t pc);
+   protected:
+      void train(uint64_t pc, bool taken);
+   public:
+      Gshare();
+      const char * getName() { return "gshare"; }
+      bool predict(uint64_t pc, uint64_t target);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+};
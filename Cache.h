@@ -0,0 +1,51 @@
+class Checkpoint;
+
+//replacement policies
+#define CACHE_LRU 0       //replace the line used longest ago
+#define CACHE_FIFO 1      //replace the line filled longest ago
+#define CACHE_RANDOM 2    //replace a line picked by a pseudo-random sequence
+
+//largest size of a cache in bytes
+#define MAXCACHESIZE 0x1000000
+
+//largest number of cycles a miss waits
+#define MAXCACHELATENCY 0x10000
+
+//tag of an empty line
+#define NOTAG ((uint64_t) -1)
+
+//timing model of a set-associative cache: it only keeps the tags of
+//the lines it holds, to tell the stage that uses it how many cycles an
+//access has to wait. Memory still holds all of the data. Writes are
+//treated like reads (write-allocate, and write-backs cost nothing).
+class Cache
+{
+   private:
+      int32_t size;          //bytes
+      int32_t assoc;         //lines in a set
+      int32_t lineSize;      //bytes (a power of 2)
+      int32_t numSets;       //a power of 2
+      int32_t policy;
+      int32_t latency;       //cycles a miss waits
+      int32_t lineBits;      //log2(lineSize)
+      uint64_t * tags;       //assoc entries for each set
+      uint64_t * stamps;     //time each line was last used (LRU) or filled
+      uint64_t time;         //number of lines accessed so far
+      uint64_t seed;         //state of the CACHE_RANDOM sequence
+      uint64_t hits;
+      uint64_t misses;
+      uint64_t stallCycles;
+      bool accessLine(uint64_t line);
+   public:
+      Cache(int32_t size, int32_t assoc, int32_t lineSize, int32_t policy, int32_t latency);
+      ~Cache();
+      static Cache * create(const char * config);
+      int32_t access(uint64_t address, int32_t length);
+      void stall();
+      uint64_t getHits();
+      uint64_t getMisses();
+      uint64_t getStallCycles();
+      void dump(std::ostream & out, const char * name);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+};
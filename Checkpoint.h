@@ -0,0 +1,31 @@
+class Machine;
+
+//kinds of snapshots in a checkpoint file
+#define FULLSNAPSHOT 0    //holds all of memory
+#define DELTASNAPSHOT 1   //holds the memory lines changed since the last one
+
+//writes snapshots of the state of a Machine to a checkpoint file and
+//restores the state of the Machine from one of those snapshots
+class Checkpoint
+{
+   private:
+      Machine * machine;
+      std::ofstream * file;   //snapshots are appended here (NULL if none)
+      int32_t numSnapshots;   //number written to file
+      char * buffer;          //contents of the snapshot being built or read
+      int64_t size;           //number of bytes in buffer
+      int64_t capacity;
+      int64_t pos;            //next byte of buffer to get
+      bool error;             //true if get went past the end of buffer
+   public:
+      Checkpoint(Machine * machine);
+      ~Checkpoint();
+      bool create(char * fileName, const std::string & options);
+      void snapshot(int32_t cycle);
+      bool restore(char * fileName, int32_t cycle, const std::string & options,
+                   bool & mismatch);
+      void put(const void * data, int64_t length);
+      void get(void * data, int64_t length);
+      int64_t remaining();
+      void invalidate();
+};
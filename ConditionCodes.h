@@ -1,19 +1,37 @@
+class Checkpoint;
+
 //The actual bits used within the codes register are
 //arbitrary. Use OF, SF, ZF in your code, not 3, 6, 2
 #define OF 3   //bit 3 of codes
 #define SF 6   //bit 6 of codes
 #define ZF 2   //bit 2 of codes
 
+//The codes set by an OPq are not computed until they are read: setALU
+//only saves the operation and its operands, and evaluate computes the
+//codes from them the first time a jXX, cmovXX, dump or get needs them.
 class ConditionCodes 
 {
    private:
-      static ConditionCodes * ccInstance;
-      ConditionCodes();
       uint64_t codes;
+      bool pending;           //true if codes must be computed from the
+                              //operation below
+      uint8_t aluFun;         //ifun of the last OPq
+      uint64_t aluA;          //its operands and result
+      uint64_t aluB;
+      uint64_t aluE;
+      uint64_t dumpedCodes;   //codes output by the last dumpChanges
+      bool dumped;            //true once dumpedCodes is valid
+      void evaluate();
    public:
-      static ConditionCodes * getInstance();      
+      ConditionCodes();
+      ConditionCodes * clone();
       bool getConditionCode(int32_t ccNum, bool & error);
       void setConditionCode(bool value, int32_t ccNum, 
                             bool & error);
-      void dump();
+      void setALU(uint8_t ifun, uint64_t aluA, uint64_t aluB, uint64_t valE);
+      bool satisfies(uint8_t ifun);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+      void dump(std::ostream & out);
+      void dumpChanges(std::ostream & out);
 }; 
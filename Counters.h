@@ -0,0 +1,69 @@
+class Checkpoint;
+class PipeReg;
+class Stage;
+
+//causes of the cycles that the pipeline loses
+#define LOADUSE 0      //an instruction in D uses the register a load in E reads
+#define RETURN 1       //a ret that wasn't predicted is in D, E or M, or one was mispredicted
+#define MISPREDICT 2   //the jump in E was mispredicted
+#define EXCEPTION 3    //the instruction in M or W has a status other than AOK
+#define CACHEMISS 4    //the instruction in F or M missed the instruction or data cache
+#define NUMCAUSES 5
+#define NOCAUSE NUMCAUSES   //an instruction, or a nop the pipeline started with
+
+//number of icodes that fit in the four bits of the field
+#define NUMICODES 16
+//number of entries the table of pc counts starts with (a power of 2)
+#define PCTABLESIZE 256
+
+//counts for the instruction at one address
+struct PCCounts
+{
+   uint64_t pc;          //NOPC if the entry is unused
+   uint64_t retired;     //times the instruction reached the W register
+   uint64_t lost;        //cycles lost to bubbles the instruction caused
+};
+
+//why the D, E, M or W register holds a bubble and the instruction
+//that caused it
+struct BubbleSlot
+{
+   int32_t cause;        //LOADUSE ... CACHEMISS, or NOCAUSE
+   uint64_t pc;
+   uint8_t icode;
+};
+
+//performance counters of the pipeline: cycles, retired instructions,
+//stalls, bubbles and the cycles the bubbles cost broken down by their
+//cause, and counts for each instruction address and icode
+class Counters
+{
+   private:
+      uint64_t cycles;
+      uint64_t retired;
+      uint64_t stalls[NUMCAUSES];       //cycles the F and D registers stalled
+      uint64_t bubbles[NUMCAUSES];      //bubbles put in D, E and M
+      uint64_t lost[NUMCAUSES + 1];     //cycles a bubble of each cause was
+                                        //in W (NOCAUSE: the pipeline filling)
+      uint64_t icodeRetired[NUMICODES];
+      uint64_t icodeLost[NUMICODES];
+      BubbleSlot slots[NUMPIPEREGS];    //the bubbles in D, E, M and W
+      PCCounts * pcs;                   //hash table of counts keyed by pc
+      int32_t pcSize;                   //number of entries (a power of 2)
+      int32_t numPCs;                   //number of entries in use
+      PCCounts * find(uint64_t pc);
+      void grow();
+      BubbleSlot bubble(int32_t cause, uint64_t pc, uint8_t icode);
+      void reset();
+      void dumpCauses(std::ostream & out, const char * name, 
+                      uint64_t * counts, int32_t num);
+   public:
+      Counters();
+      ~Counters();
+      void count(PipeReg ** pregs, Stage ** stages);
+      uint64_t getCycles();
+      uint64_t getRetired();
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+      void dumpJSON(std::ostream & out);
+};
@@ -2,21 +2,55 @@
 class D : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * ifun;
-      PipeRegField * rA;
-      PipeRegField * rB;
-      PipeRegField * valC;
-      PipeRegField * valP;
+      //the fields of the register; the stages write input and read
+      //state, and the control signals applied when the clock rises
+      //copy input (normal) or a nop (bubble) into state
+      struct Fields
+      {
+         uint64_t valC;
+         uint64_t valP;
+         uint64_t pc;      //address of the instruction (NOPC for a bubble); 
+                           //not dumped
+         uint64_t predPC;  //pc fetch predicted would follow the instruction
+                           //(NOPC for a ret it had no prediction for); 
+                           //not dumped
+         uint8_t stat;
+         uint8_t icode;
+         uint8_t ifun;
+         uint8_t rA;
+         uint8_t rB;
+         uint8_t predTaken; //1 if fetch predicted the jump taken; 
+                            //not dumped
+      };
+      Fields input;
+      Fields state;
+      static const Fields nop;
    public:
       D();
-      PipeRegField * getstat();
-      PipeRegField * geticode();
-      PipeRegField * getifun();
-      PipeRegField * getrA();
-      PipeRegField * getrB();
-      PipeRegField * getvalC();
-      PipeRegField * getvalP();
-      void dump();
+      uint8_t getstat() { return state.stat; }
+      uint8_t geticode() { return state.icode; }
+      uint8_t getifun() { return state.ifun; }
+      uint8_t getrA() { return state.rA; }
+      uint8_t getrB() { return state.rB; }
+      uint64_t getvalC() { return state.valC; }
+      uint64_t getvalP() { return state.valP; }
+      uint64_t getpc() { return state.pc; }
+      uint64_t getpredPC() { return state.predPC; }
+      uint8_t getpredTaken() { return state.predTaken; }
+      void setstat(uint64_t stat) { input.stat = stat; }
+      void seticode(uint64_t icode) { input.icode = icode; }
+      void setifun(uint64_t ifun) { input.ifun = ifun; }
+      void setrA(uint64_t rA) { input.rA = rA; }
+      void setrB(uint64_t rB) { input.rB = rB; }
+      void setvalC(uint64_t valC) { input.valC = valC; }
+      void setvalP(uint64_t valP) { input.valP = valP; }
+      void setpc(uint64_t pc) { input.pc = pc; }
+      void setpredPC(uint64_t predPC) { input.predPC = predPC; }
+      void setpredTaken(uint8_t predTaken) { input.predTaken = predTaken; }
+      void normal() { state = input; }
+      void stall() { }
+      void bubble() { state = nop; }
+      void dump(std::ostream & out);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
 };
@@ -1,17 +1,20 @@
+class Checkpoint;
+class RegisterFile;
+
 //class to perform the combinational logic of
 //the Fetch stage
 class DecodeStage: public Stage
 {
     private:
+        RegisterFile * regFile;
         uint8_t srcA;
         uint8_t srcB;
+        bool E_stall;
         bool E_bubble;
         
-        bool EBubble(uint8_t E_icode, uint8_t E_dstM, bool e_Cnd, 
-        uint8_t d_srcA, uint8_t d_srcB);
+        bool EBubble(uint8_t E_icode, uint8_t E_dstM, bool e_mispredict, 
+        bool m_retMispredict, uint8_t d_srcA, uint8_t d_srcB);
         
-        void doEBubble(PipeReg ** pregs);
-        void doENormal(PipeReg ** pregs);
         void setEInput(E * dreg, uint64_t stat, uint64_t icode, uint64_t ifun, 
                 uint64_t valC, uint64_t valA, uint64_t valB, uint64_t dstE,
                 uint64_t dstM, uint64_t srcA, uint64_t srcB);
@@ -26,11 +29,15 @@ class DecodeStage: public Stage
         uint8_t getd_srcB(D * dreg, uint8_t icode);
 
     public:
+        DecodeStage(RegisterFile * regFile);
+        void save(Checkpoint * ckpt);
+        void restore(Checkpoint * ckpt);
         bool doClockLow(PipeReg ** pregs, Stage ** stages);
         void doClockHigh(PipeReg ** pregs);
 
         uint8_t get_srcA();
         uint8_t get_srcB();
+        bool getE_bubble();
 
 
 };
@@ -2,27 +2,64 @@
 class E : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * ifun;
-      PipeRegField * valC;
-      PipeRegField * valA;
-      PipeRegField * valB;
-      PipeRegField * dstE;
-      PipeRegField * dstM;
-      PipeRegField * srcA;
-      PipeRegField * srcB;
+      //the fields of the register; the stages write input and read
+      //state, and the control signals applied when the clock rises
+      //copy input (normal) or a nop (bubble) into state
+      struct Fields
+      {
+         uint64_t valC;
+         uint64_t valA;
+         uint64_t valB;
+         uint64_t pc;      //address of the instruction (NOPC for a bubble); 
+                           //not dumped
+         uint64_t predPC;  //pc fetch predicted would follow the instruction
+                           //(NOPC for a ret it had no prediction for); 
+                           //not dumped
+         uint8_t stat;
+         uint8_t icode;
+         uint8_t ifun;
+         uint8_t dstE;
+         uint8_t dstM;
+         uint8_t srcA;
+         uint8_t srcB;
+         uint8_t predTaken; //1 if fetch predicted the jump taken; 
+                            //not dumped
+      };
+      Fields input;
+      Fields state;
+      static const Fields nop;
    public:
       E();
-      PipeRegField * getstat();
-      PipeRegField * geticode();
-      PipeRegField * getifun();
-      PipeRegField * getvalC();
-      PipeRegField * getvalA();
-      PipeRegField * getvalB();
-      PipeRegField * getdstE();
-      PipeRegField * getdstM();
-      PipeRegField * getsrcA();
-      PipeRegField * getsrcB();
-      void dump();
+      uint8_t getstat() { return state.stat; }
+      uint8_t geticode() { return state.icode; }
+      uint8_t getifun() { return state.ifun; }
+      uint64_t getvalC() { return state.valC; }
+      uint64_t getvalA() { return state.valA; }
+      uint64_t getvalB() { return state.valB; }
+      uint8_t getdstE() { return state.dstE; }
+      uint8_t getdstM() { return state.dstM; }
+      uint8_t getsrcA() { return state.srcA; }
+      uint8_t getsrcB() { return state.srcB; }
+      uint64_t getpc() { return state.pc; }
+      uint64_t getpredPC() { return state.predPC; }
+      uint8_t getpredTaken() { return state.predTaken; }
+      void setstat(uint64_t stat) { input.stat = stat; }
+      void seticode(uint64_t icode) { input.icode = icode; }
+      void setifun(uint64_t ifun) { input.ifun = ifun; }
+      void setvalC(uint64_t valC) { input.valC = valC; }
+      void setvalA(uint64_t valA) { input.valA = valA; }
+      void setvalB(uint64_t valB) { input.valB = valB; }
+      void setdstE(uint64_t dstE) { input.dstE = dstE; }
+      void setdstM(uint64_t dstM) { input.dstM = dstM; }
+      void setsrcA(uint64_t srcA) { input.srcA = srcA; }
+      void setsrcB(uint64_t srcB) { input.srcB = srcB; }
+      void setpc(uint64_t pc) { input.pc = pc; }
+      void setpredPC(uint64_t predPC) { input.predPC = predPC; }
+      void setpredTaken(uint8_t predTaken) { input.predTaken = predTaken; }
+      void normal() { state = input; }
+      void stall() { }
+      void bubble() { state = nop; }
+      void dump(std::ostream & out);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
 };
@@ -2,9 +2,22 @@
 class F : public PipeReg
 {
    private:
-      PipeRegField * predPC;
+      //the fields of the register; the stages write input and read
+      //state, and the normal control signal applied when the clock
+      //rises copies input into state
+      struct Fields
+      {
+         uint64_t predPC;
+      };
+      Fields input;
+      Fields state;
    public:
       F();
-      PipeRegField * getpredPC();
-      void dump();
+      uint64_t getpredPC() { return state.predPC; }
+      void setpredPC(uint64_t predPC) { input.predPC = predPC; }
+      void normal() { state = input; }
+      void stall() { }
+      void dump(std::ostream & out);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
 };
@@ -1,3 +1,9 @@
+class Checkpoint;
+class Memory;
+class BranchPredictor;
+class ReturnStack;
+class Cache;
+
 //class to perform the combinational logic of
 //the Fetch stage
 #define NUM_REGIDS 7
@@ -7,16 +13,22 @@
 class FetchStage: public Stage
 {
     private:
+        Memory * mem;
+        PredecodeCache * predecode;
+        BranchPredictor * predictor;   //predicts conditional jumps
+        ReturnStack * returns;         //predicts rets (NULL if none)
+        Cache * icache;                //times the fetches (NULL if none)
+        Predecoded uncached;    //decoded instruction for a pc outside of memory
+        Predecoded * decode(uint64_t f_pc);
         void setDInput(D * dreg, uint64_t stat, uint64_t icode, uint64_t ifun, 
                 uint64_t rA, uint64_t rB,
                 uint64_t valC, uint64_t valP);
         void getRegIds(uint64_t f_pc, uint8_t icode, uint8_t &rA, uint8_t &rB);
-        void doDNormal(PipeReg ** pregs);
-        void doDStall(PipeReg ** pregs);
-        void doDBubble(PipeReg ** pregs);
         
-        uint64_t selectPC(F* freg, M* mreg, W* wreg);
-        uint64_t  predictPC(uint64_t f_icode, uint64_t f_valC, uint64_t f_valP);
+        void train(E* ereg, M* mreg, ExecuteStage * e, MemoryStage * m);
+        uint64_t selectPC(F* freg, M* mreg, W* wreg, MemoryStage * m);
+        uint64_t  predictPC(uint64_t f_pc, uint64_t f_icode, uint64_t f_ifun,
+                uint64_t f_valC, uint64_t f_valP, bool & taken);
         uint64_t PCincrement(uint64_t f_icode, bool nregids, bool nvalC);
         uint64_t buildValC(uint64_t f_pc, uint8_t icode);
 
@@ -26,17 +38,43 @@ class FetchStage: public Stage
         
         bool instr_valid(uint8_t icode);
         bool mem_error(uint32_t addr);
-        bool FStall(E* ereg, DecodeStage * d, uint8_t D_icode, uint8_t E_icode, uint8_t M_icode);
+        bool FStall(E* ereg, DecodeStage * d, bool D_ret, bool E_ret, bool M_ret,
+                bool m_retMispredict);
         bool need_regids(uint64_t f_icode);
         bool needValC(uint64_t f_icode);
-        bool doDBubble(uint8_t D_icode, uint8_t E_icode, 
-        uint8_t M_icode, uint8_t E_dstM,bool e_cnd, uint8_t d_srcA, uint8_t d_srcB);
+        bool doDBubble(bool D_ret, bool E_ret, bool M_ret, uint8_t E_icode, 
+        uint8_t E_dstM, bool e_mispredict, bool m_retMispredict, uint8_t d_srcA, uint8_t d_srcB);
         
         bool F_stall;
         bool D_stall;
         bool D_bubble;
+        uint64_t fetchedPC;      //f_pc and f_icode of this cycle (for a trace)
+        uint8_t fetchedIcode;
+        bool fetchMiss;          //D gets a bubble for an instruction cache miss
+        uint64_t lastPC;         //f_pc of the last cycle
+        bool lastHeld;           //true if that instruction didn't go into D
+        int32_t missWait;        //cycles left until a miss has been filled
+        bool draining;           //true if nothing new goes into D (setDrain)
 
     public:
+        FetchStage(Memory * mem);
+        ~FetchStage();
+        PredecodeCache * getPredecodeCache();
+        void setPredictor(BranchPredictor * predictor);
+        void setReturnStack(ReturnStack * returns);
+        void setInstructionCache(Cache * icache);
+        void setDrain(bool drain);
+        BranchPredictor * getPredictor();
+        ReturnStack * getReturnStack();
+        Cache * getInstructionCache();
+        bool getfetchMiss();
+        uint64_t getf_pc();
+        uint8_t getf_icode();
+        bool getF_stall();
+        bool getD_bubble();
+        void save(Checkpoint * ckpt);
+        void restore(Checkpoint * ckpt);
+        void redecode();
         bool doClockLow(PipeReg ** pregs, Stage ** stages);
         void doClockHigh(PipeReg ** pregs);
 
@@ -0,0 +1,62 @@
+class BlockCache;
+struct Block;
+struct TranslatedOp;
+
+//class to execute y86 instructions sequentially, one instruction
+//per step, without simulating the stages of the PIPE machine. With
+//translation on, run executes basic blocks of translated instructions
+//instead.
+class Functional
+{
+   private:
+      Memory * mem;
+      RegisterFile * rf;
+      ConditionCodes * cc;
+      uint64_t pc;             //address of the next instruction
+      uint64_t stat;           //SAOK until an instruction stops the machine
+      uint64_t numInstructions;
+      BlockCache * blocks;     //translated blocks (NULL if translation is off)
+      Block * current;         //block being executed
+      int32_t exitLink;        //exit the block is left by: 0, 1 or NOLINK
+      uint64_t exits;          //number of times a block was left
+      uint64_t chainedExits;   //times the next block was found by a link
+      uint64_t getValC(uint64_t addr);
+      bool cond(uint8_t ifun);
+      void setCC(uint8_t ifun, uint64_t aluA, uint64_t aluB, uint64_t valE);
+      uint64_t runTranslated();
+      Block * translate(uint64_t start);
+      Block * execute(Block * block);
+      bool fault(const TranslatedOp * op);
+      bool afterWrite(const TranslatedOp * op);
+      static bool opNop(Functional * isa, const TranslatedOp * op);
+      static bool opHalt(Functional * isa, const TranslatedOp * op);
+      static bool opRrmovq(Functional * isa, const TranslatedOp * op);
+      static bool opCmovXX(Functional * isa, const TranslatedOp * op);
+      static bool opIrmovq(Functional * isa, const TranslatedOp * op);
+      static bool opRmmovq(Functional * isa, const TranslatedOp * op);
+      static bool opMrmovq(Functional * isa, const TranslatedOp * op);
+      static bool opOpq(Functional * isa, const TranslatedOp * op);
+      static bool opJmp(Functional * isa, const TranslatedOp * op);
+      static bool opJXX(Functional * isa, const TranslatedOp * op);
+      static bool opCall(Functional * isa, const TranslatedOp * op);
+      static bool opRet(Functional * isa, const TranslatedOp * op);
+      static bool opPushq(Functional * isa, const TranslatedOp * op);
+      static bool opPopq(Functional * isa, const TranslatedOp * op);
+   public:
+      Functional(Memory * mem, RegisterFile * rf, ConditionCodes * cc);
+      ~Functional();
+      void setTranslation(bool translate);
+      uint64_t step();
+      uint64_t run();
+      void resume(uint64_t pc, uint64_t instructions);
+      uint64_t getPC();
+      uint64_t getStat();
+      uint64_t getInstructions();
+      BlockCache * getBlockCache();
+      uint64_t getExits();
+      uint64_t getChainedExits();
+      Memory * getMemory();
+      RegisterFile * getRegisterFile();
+      ConditionCodes * getConditionCodes();
+      void dump(std::ostream & out);
+};
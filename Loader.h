@@ -1,19 +1,48 @@
+class Memory;
+class Machine;
+class Assembler;
+
+//a run of consecutive bytes loaded into memory
+struct Segment
+{
+   int32_t address;
+   int32_t length;
+};
+
 class Loader
 {
    private:
       bool loaded;        //set to true if a file is successfully loaded into memory
-      std::ifstream inf;  //input file handle
+      Memory * mem;       //memory the program is loaded into
+      std::ostream * out; //errors are output here
+      int32_t lastAddr;   //address after the last byte loaded
+      Segment * segments; //runs of bytes loaded, in the order they were loaded
+      int32_t numSegments;
+      int32_t maxSegments;
+      Assembler * assembler; //assembled the program if it was a .ys (else NULL)
       bool isValidFile(char* s);
+      bool isImageFile(char* s);
+      bool isSourceFile(char* s);
+      const char * readFile(char * name, int32_t & size, bool & mapped);
+      bool loadProgram(const char * buffer, int32_t size);
+      bool loadImage(const char * buffer, int32_t size);
+      bool loadSource(const char * buffer, int32_t size);
+      void addSegment(int32_t address, int32_t length);
+      uint32_t getWord(const char * ptr);
+      void putWord(char * ptr, uint32_t value);
    public:
-      Loader(int argc, char * argv[]);
+      Loader(char * fileName, Machine * machine);
+      ~Loader();
       bool isLoaded();
-      bool isCommentRecord(std::string line);
-      bool isDataRecord(std::string line);
-      bool isValidAddress(std::string line);
-      bool hasErrors(std::string line);
-      bool isValidData(std::string line);
-      bool isHexData(std::string line);
-      bool isHexAddr(std::string line);
-      int getDataSize(std::string line);
-      int convert(std::string s, int begin, int end);  
+      bool writeImage(char * name);
+      bool writeListing(char * name);
+      bool isCommentRecord(const char * line);
+      bool isDataRecord(const char * line);
+      bool isValidAddress(const char * line);
+      bool hasErrors(const char * line, int32_t length);
+      bool isValidData(const char * line);
+      bool isHexData(const char * line);
+      bool isHexAddr(const char * line);
+      int getDataSize(const char * line);
+      int convert(const char * line, int begin, int end);  
 };
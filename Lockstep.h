@@ -0,0 +1,18 @@
+//class to run the PIPE machine and the Functional machine side by side
+//and report the first instruction where their architectural state differs
+class Lockstep
+{
+   private:
+      Machine * pipe;
+      Simulate * simulate;    //the pipeline of pipe
+      std::ostream & out;     //output stream of pipe
+      Functional * isa;
+      uint64_t retired;       //number of instructions retired by the pipeline
+      bool checkRegisters();
+      bool checkConditionCodes();
+      bool checkMemory();
+      void report(uint64_t pc, uint8_t icode);
+   public:
+      Lockstep(Machine * pipe, Functional * isa);
+      bool run();
+};
@@ -2,21 +2,55 @@
 class M : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * Cnd;
-      PipeRegField * valE;
-      PipeRegField * valA;
-      PipeRegField * dstE;
-      PipeRegField * dstM;
+      //the fields of the register; the stages write input and read
+      //state, and the control signals applied when the clock rises
+      //copy input (normal) or a nop (bubble) into state
+      struct Fields
+      {
+         uint64_t valE;
+         uint64_t valA;
+         uint64_t pc;      //address of the instruction (NOPC for a bubble); 
+                           //not dumped
+         uint64_t predPC;  //pc fetch predicted would follow the instruction
+                           //(NOPC for a ret it had no prediction for); 
+                           //not dumped
+         uint8_t stat;
+         uint8_t icode;
+         uint8_t Cnd;
+         uint8_t dstE;
+         uint8_t dstM;
+         uint8_t mispredict; //1 if the instruction is a mispredicted jump;
+                             //not dumped
+      };
+      Fields input;
+      Fields state;
+      static const Fields nop;
    public:
       M();
-      PipeRegField * getstat();
-      PipeRegField * geticode();
-      PipeRegField * getCnd();
-      PipeRegField * getvalE();
-      PipeRegField * getvalA();
-      PipeRegField * getdstE();
-      PipeRegField * getdstM();
-      void dump();
+      uint8_t getstat() { return state.stat; }
+      uint8_t geticode() { return state.icode; }
+      uint8_t getCnd() { return state.Cnd; }
+      uint64_t getvalE() { return state.valE; }
+      uint64_t getvalA() { return state.valA; }
+      uint8_t getdstE() { return state.dstE; }
+      uint8_t getdstM() { return state.dstM; }
+      uint64_t getpc() { return state.pc; }
+      uint64_t getpredPC() { return state.predPC; }
+      uint8_t getmispredict() { return state.mispredict; }
+      void setstat(uint64_t stat) { input.stat = stat; }
+      void seticode(uint64_t icode) { input.icode = icode; }
+      void setCnd(uint64_t Cnd) { input.Cnd = Cnd; }
+      void setvalE(uint64_t valE) { input.valE = valE; }
+      void setvalA(uint64_t valA) { input.valA = valA; }
+      void setdstE(uint64_t dstE) { input.dstE = dstE; }
+      void setdstM(uint64_t dstM) { input.dstM = dstM; }
+      void setpc(uint64_t pc) { input.pc = pc; }
+      void setpredPC(uint64_t predPC) { input.predPC = predPC; }
+      void setmispredict(uint64_t mispredict) { input.mispredict = mispredict; }
+      void normal() { state = input; }
+      void stall() { }
+      void bubble() { state = nop; }
+      void dump(std::ostream & out);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
 };
@@ -0,0 +1,29 @@
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class Simulate;
+
+//the context of one simulated machine: its Memory, RegisterFile,
+//ConditionCodes and pipeline (the pipelined registers and stages in
+//Simulate), and the stream its output is written to. Machines share
+//nothing, so several of them can be simulated at once on different
+//threads, except the cores of a Multicore, which share one Memory.
+class Machine
+{
+   private:
+      Memory * mem;
+      RegisterFile * rf;
+      ConditionCodes * cc;
+      Simulate * simulate;
+      std::ostream * out;
+      bool ownsMemory;        //false if mem belongs to another Machine
+   public:
+      Machine(int32_t memSize, bool mapped, std::ostream & out);
+      Machine(Memory * mem, std::ostream & out);
+      ~Machine();
+      Memory * getMemory();
+      RegisterFile * getRegisterFile();
+      ConditionCodes * getConditionCodes();
+      Simulate * getSimulate();
+      std::ostream & getOutput();
+};
@@ -1,17 +1,65 @@
+class PredecodeCache;
+class BlockCache;
+class Checkpoint;
 
-//size of memory
+//default and largest size of memory
 #define MEMSIZE 0x1000
+#define MAXMEMSIZE 0x40000000
+//size of a page of memory; pages are allocated when first written
+#define PAGESIZE 0x1000
+#define PAGEBITS 12
+//number of bytes output per line by dump (four 64-bit words)
+#define LINESIZE 32
+#define LINESPERPAGE (PAGESIZE / LINESIZE)
+//bits of the flags kept for each line
+#define DUMPDIRTY 1   //written since the last dumpChanges
+#define SNAPDIRTY 2   //written since the last snapshot was saved
+
 class Memory 
 {
    private:
-      static Memory * memInstance;
-      Memory();
-      uint8_t mem[MEMSIZE];
+      static uint8_t zeroPage[PAGESIZE];  //read by pages not yet written
+      int32_t size;                  //number of bytes of memory
+      int32_t numPages;
+      uint8_t ** pages;              //pages[i] holds bytes i*PAGESIZE...
+      bool * touched;                //true if page has been written
+      uint8_t * mapping;             //mmap-ed memory if mapped, else NULL
+      uint8_t ** dirty;              //per page: DUMPDIRTY and SNAPDIRTY 
+                                     //flags of each line (NULL if untouched)
+      int32_t * dirtyLines;          //numbers of the DUMPDIRTY lines
+      int32_t numDirty;
+      int32_t maxDirty;              //capacity of dirtyLines
+      int32_t * snapLines;           //numbers of the SNAPDIRTY lines
+      int32_t numSnap;
+      int32_t maxSnap;               //capacity of snapLines
+      bool snapshots;                //true once a snapshot has been saved
+      bool dumped;                   //true once dumpChanges has been called
+      PredecodeCache ** predecode;   //invalidated when memory is written
+                                     //(one per pipeline that fetches from it)
+      int32_t numPredecode;
+      int32_t maxPredecode;          //capacity of predecode
+      BlockCache * blocks;           //invalidated when memory is written
+      uint8_t * touch(int32_t address);
+      void markDirty(int32_t address);
+      void addLine(int32_t * & lines, int32_t & num, int32_t & max, int32_t line);
+      void dumpLine(std::ostream & out, int32_t address);
    public:
-      static Memory * getInstance();      
+      Memory(int32_t size, bool mapped);
+      ~Memory();
+      Memory * clone();
+      void addPredecodeCache(PredecodeCache * predecode);
+      void removePredecodeCache(PredecodeCache * predecode);
+      void setBlockCache(BlockCache * blocks);
+      int32_t getSize();
+      int32_t compare(Memory * other);
       uint64_t getLong(int32_t address, bool & error);
       uint8_t getByte(int32_t address, bool & error);
       void putLong(uint64_t value, int32_t address, bool & error);
       void putByte(uint8_t value, int32_t address, bool & error);
-      void dump();
+      void getBytes(uint8_t * bytes, int32_t address, int32_t length, bool & error);
+      void putBytes(const uint8_t * bytes, int32_t address, int32_t length, bool & error);
+      void save(Checkpoint * ckpt, bool full);
+      bool restore(Checkpoint * ckpt);
+      void dump(std::ostream & out);
+      void dumpChanges(std::ostream & out);
 }; 
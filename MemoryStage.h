@@ -1,10 +1,21 @@
+class Checkpoint;
+class Memory;
+class Cache;
+class StoreBuffer;
+
 //class to perform the combinational logic of
 //the Fetch stage
 class MemoryStage: public Stage
 {
    private:
+      Memory * mem;
+      Cache * dcache;         //times the reads and writes (NULL if none)
+      StoreBuffer * buffer;   //holds the writes of a core (NULL: write to mem)
       uint64_t valM;
       uint64_t stat;
+      bool retMispredict;
+      bool M_stall;
+      int32_t dataWait;       //cycles left until a miss has been filled
       void setWinput(W * wreg, uint64_t stat, uint64_t icode,
                      uint64_t valE, uint64_t valM,
                      uint64_t dstE, uint64_t dstM);
@@ -13,8 +24,17 @@ class MemoryStage: public Stage
         bool mem_read(uint8_t M_icode);
    
    public:
+      MemoryStage(Memory * mem);
+      ~MemoryStage();
+      void setDataCache(Cache * dcache);
+      Cache * getDataCache();
+      void setStoreBuffer(StoreBuffer * buffer);
       int64_t getm_valM();
       uint64_t getm_stat();
+      bool getm_retMispredict();
+      bool getM_stall();
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
       bool doClockLow(PipeReg ** pregs, Stage ** stages);
       void doClockHigh(PipeReg ** pregs);
 };
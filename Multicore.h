@@ -0,0 +1,48 @@
+class Machine;
+class StoreBuffer;
+
+//largest number of cores
+#define MAXCORES 64
+//default number of cycles each core simulates between synchronizations
+#define QUANTUM 1000
+
+//a core of a Multicore: a Machine that shares the Memory of the others
+struct Core
+{
+   Machine * machine;
+   StoreBuffer * buffer;   //the writes of the quantum being simulated
+   bool stopped;           //true once an instruction in W has stopped it
+   uint64_t stat;          //stat of that instruction (SAOK while running)
+};
+
+//class to simulate several PIPE machines (cores) that share one
+//Memory, each with its own pipeline, RegisterFile and ConditionCodes.
+//Every core runs on its own host thread for a quantum of cycles, then
+//waits for the others; the writes of the quantum are committed to
+//memory in core order before the next one starts, so the result is the
+//same however the threads are scheduled.
+class Multicore
+{
+   private:
+      Machine * machine;      //holds the shared Memory
+      Core * cores;
+      int32_t numCores;
+      int32_t quantum;
+      uint64_t quanta;        //number of quanta simulated
+      std::mutex lock;        //guards generation, running and done
+      std::condition_variable start;     //a quantum has started
+      std::condition_variable finished;  //every core has finished it
+      uint64_t generation;    //number of the quantum the cores are simulating
+      int32_t running;        //number of worker threads not done with it
+      bool done;              //true once every core has stopped
+      void work(int32_t core);
+      void runQuantum(int32_t core);
+   public:
+      Multicore(Machine * machine, int32_t numCores, int32_t quantum);
+      ~Multicore();
+      Machine * getCore(int32_t core);
+      void run();
+      uint64_t getCycles();
+      uint64_t getInstructions();
+      void dump(std::ostream & out);
+};
@@ -1,3 +1,4 @@
+class Checkpoint;
 
 //these can be used as indices into an array of PipeReg
 #define FREG 0
@@ -6,9 +7,15 @@
 #define MREG 3
 #define WREG 4
 
+//pc field of a bubble, which is not an instruction
+#define NOPC ((uint64_t) -1)
+
 //number of PipeRegisters
 #define NUMPIPEREGS 5
 
+//largest number of fields in a pipeline register (E has 10)
+#define MAXFIELDS 16
+
 //base class for the F, D, E, M, W pipeline registers
 class PipeReg
 {
@@ -18,8 +25,19 @@ class PipeReg
       //
       //dump is abstract
       //virtual makes it polymorphic 
-      virtual void dump() = 0;
+      virtual void dump(std::ostream & out) = 0;
+      virtual ~PipeReg() { }
+      virtual void save(Checkpoint * ckpt);
+      virtual void restore(Checkpoint * ckpt);
+      void dumpChanges(std::ostream & out);
    protected:
-      void dumpField(std::string label, int width, uint64_t value, bool nl);
+      void dumpField(std::ostream & out, std::string label, int width, 
+                     uint64_t value, bool nl);
+   private:
+      bool diffing = false;     //true while dumpChanges is running
+      bool dumped = false;      //true once lastValue holds a dumped state
+      bool lineStarted;         //true once a changed field has been output
+      int fieldNum;             //index of the next field passed to dumpField
+      std::string regName;      //"F:", "D:", ... taken from the first field
+      uint64_t lastValue[MAXFIELDS];
 };
-
@@ -0,0 +1,43 @@
+class Checkpoint;
+
+//number of entries in the predecode cache (a power of 2)
+#define PREDECODESIZE 1024
+//longest y86 instruction in bytes
+#define MAXINSTRSIZE 10
+
+//an instruction as decoded by the fetch stage
+struct Predecoded
+{
+   uint64_t pc;       //address of the instruction; the entry's tag
+   bool valid;
+   uint8_t stat;
+   uint8_t icode;
+   uint8_t ifun;
+   uint8_t rA;
+   uint8_t rB;
+   uint64_t valC;
+   uint64_t valP;
+};
+
+//direct-mapped cache of decoded instructions keyed by pc
+class PredecodeCache
+{
+   private:
+      Predecoded entries[PREDECODESIZE];
+      int64_t lowPC;     //lowest pc that has been inserted
+      int64_t highPC;    //highest pc that has been inserted
+      uint64_t hits;
+      uint64_t misses;
+      uint64_t invalidations;
+   public:
+      PredecodeCache();
+      Predecoded * lookup(uint64_t pc);
+      Predecoded * insert(uint64_t pc);
+      void invalidate(int32_t address, int32_t size);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+      Predecoded * getEntry(int32_t index);
+      uint64_t getHits();
+      uint64_t getMisses();
+      uint64_t getInvalidations();
+};
@@ -1,3 +1,5 @@
+class Checkpoint;
+
 #define REGSIZE 15  //size of register file
 //register numbers of Y86 registers
 #define RAX 0
@@ -20,13 +22,17 @@
 class RegisterFile 
 {
    private:
-      static RegisterFile * regInstance;
-      RegisterFile();
       uint64_t reg[REGSIZE];
+      uint64_t dumpedReg[REGSIZE];  //values output by the last dumpChanges
+      bool dumped;                  //true once dumpedReg is valid
    public:
-      static RegisterFile * getInstance();      
+      RegisterFile();
+      RegisterFile * clone();
       uint64_t readRegister(int32_t regNumber, bool & error);
       void writeRegister(uint64_t value, int32_t regNumber, 
                         bool & error);
-      void dump();
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+      void dump(std::ostream & out);
+      void dumpChanges(std::ostream & out);
 }; 
@@ -0,0 +1,32 @@
+class Checkpoint;
+
+//largest number of return addresses the stack can hold
+#define MAXRETURNDEPTH 1024
+
+//stack of the return addresses of the calls the fetch stage has
+//fetched, used to predict where a ret goes
+class ReturnStack
+{
+   private:
+      uint64_t * addresses;   //circular; a push onto a full stack 
+                              //replaces the oldest address
+      int32_t depth;          //number of addresses the stack can hold
+      int32_t top;            //index of the next address pushed
+      int32_t count;          //number of addresses on the stack
+      uint64_t predictions;   //rets that were predicted and resolved
+      uint64_t mispredictions;
+      uint64_t unpredicted;   //rets fetched while the stack was empty
+   public:
+      ReturnStack(int32_t depth);
+      ~ReturnStack();
+      bool isEmpty();
+      uint64_t peek();
+      void push(uint64_t address);
+      void pop();
+      void update(bool predicted, bool mispredicted);
+      uint64_t getPredictions();
+      uint64_t getMispredictions();
+      uint64_t getUnpredicted();
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+};
@@ -0,0 +1,44 @@
+class Machine;
+class Simulate;
+class Functional;
+class Counters;
+
+//z of a 95% confidence interval of the normal distribution
+#define CONFIDENCEZ 1.96
+
+//class to estimate the cycles the PIPE machine takes to run a program
+//by simulating the pipeline for only part of it. The Functional
+//machine executes about skip instructions (the number is picked at
+//random each time); then the pipeline starts at the pc the Functional
+//machine stopped at, runs warmup cycles to warm the predictors and
+//caches, and measures the cycles the window instructions after the
+//next one to retire take. The pipeline is drained and the Functional
+//machine continues from the next instruction, until the program stops.
+class Sampler
+{
+   private:
+      Machine * pipe;
+      Simulate * simulate;    //the pipeline of pipe
+      Counters * counters;    //the counters of the pipeline
+      Functional * isa;       //executes on the state of pipe
+      uint64_t skip;          //mean instructions executed between windows
+      uint64_t warmup;        //cycles simulated before a window
+      uint64_t window;        //instructions measured
+      uint64_t stopPC;        //pc of the instruction in W when it stopped
+      uint64_t seed;          //state of the sequence that picks the skips
+      uint64_t samples;       //number of windows measured
+      uint64_t windowCycles;  //cycles and instructions in the windows
+      uint64_t windowInstructions;
+      double sumCPI;          //sum of the CPI of the windows
+      double sumSquares;      //sum of the squares of the CPI of the windows
+      bool clock();
+      bool detail();
+      bool isEmpty();
+   public:
+      Sampler(Machine * pipe, Functional * isa, uint64_t skip, uint64_t warmup,
+              uint64_t window);
+      void run();
+      uint64_t getDetailedCycles();
+      uint64_t getInstructions();
+      void report(std::ostream & out);
+};
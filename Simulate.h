@@ -1,13 +1,62 @@
+class FetchStage;
+class DecodeStage;
+class ExecuteStage;
+class MemoryStage;
+class WritebackStage;
+class Machine;
+class Checkpoint;
+class Counters;
+class Trace;
+class BranchPredictor;
+class ReturnStack;
+class Cache;
+class StoreBuffer;
+
 //Driver class for the yess simulator
 class Simulate
 {
    private:
+      Machine * machine;
       PipeReg ** pregs;
       Stage ** stages;
+      FetchStage * fetch;
+      DecodeStage * decode;
+      ExecuteStage * execute;
+      MemoryStage * memory;
+      WritebackStage * writeback;
+      int32_t dumpInterval;  //dump every dumpInterval cycles; 0 for final only
+      bool dumpDiff;         //if true, only dump what changed since last dump
+      int32_t cycle;         //number of the next cycle to simulate
+      Checkpoint * checkpoint;     //snapshots are saved here (NULL if none)
+      int32_t checkpointInterval;  //save a snapshot every this many cycles
+      Counters * counters;   //counted at the end of every cycle run simulates
+      double dumpSeconds;    //time run spent in dumpState
+      Trace * trace;         //records each cycle run simulates (NULL if none)
+      void dumpState(int32_t cycle);
    public:
-      Simulate();
+      Simulate(Machine * machine);
+      ~Simulate();
+      void setDumpMode(int32_t dumpInterval, bool dumpDiff);
+      void setCheckpoint(Checkpoint * checkpoint, int32_t interval);
+      void setTrace(Trace * trace);
+      void setPrediction(BranchPredictor * predictor, ReturnStack * returns);
+      void setCaches(Cache * icache, Cache * dcache);
+      void setDrain(bool drain);
+      void setStoreBuffer(StoreBuffer * buffer);
+      void save(Checkpoint * ckpt);
+      void restore(Checkpoint * ckpt);
+      void redecode();
       void run();
+      bool clock();
       bool doClockLow();
       void doClockHigh();
       void dumpPipeRegs();
+      PipeReg ** getPipeRegs();
+      PredecodeCache * getPredecodeCache();
+      Counters * getCounters();
+      double getDumpSeconds();
+      BranchPredictor * getPredictor();
+      ReturnStack * getReturnStack();
+      Cache * getInstructionCache();
+      Cache * getDataCache();
 };
@@ -7,13 +7,12 @@
 //five stages: FetchStage, DecodeStage, ExecuteStage,
 //             MemoryStage, WritebackStage
 #define NUMSTAGES 5
+
+//base class for the five stages. Each stage provides
+//   bool doClockLow(PipeReg ** pregs, Stage ** stages);
+//   void doClockHigh(PipeReg ** pregs);
+//The methods are not virtual; Simulate calls them through pointers
+//to the stage classes so that the calls can be bound at compile time.
 class Stage
 {
-   public:
-      //abstract methods implemented in the descendant classes
-      //virtual makes these methods polymorphic       
-      virtual bool doClockLow(PipeReg ** pregs, Stage ** stages) = 0;
-      virtual void doClockHigh(PipeReg ** pregs) = 0;
 };
-
-
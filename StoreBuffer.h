@@ -0,0 +1,33 @@
+class Memory;
+
+//number of entries the table of stores starts with (a power of 2)
+#define STORETABLESIZE 256
+
+//the writes a core of a Multicore has made to memory during a quantum.
+//The MemoryStage of the core writes here instead of to the Memory, and
+//its reads see its own writes first; commit writes them to the Memory
+//in the order they were first made, once every core has finished the
+//quantum. Until then the other cores don't see them, so what each core
+//reads doesn't depend on how the host threads were scheduled.
+class StoreBuffer
+{
+   private:
+      Memory * mem;
+      int32_t * addresses;    //address of each word written, in the order
+      uint64_t * values;      //of the first write, and its latest value
+      int32_t numStores;
+      int32_t maxStores;      //capacity of addresses and values
+      int32_t * table;        //hash table keyed by address: 1 + the index of
+                              //the store in addresses, or 0 if empty
+      int32_t tableSize;      //number of entries (a power of 2)
+      uint64_t committed;     //number of words written to memory by commit
+      int32_t * find(int32_t address);
+      void grow();
+   public:
+      StoreBuffer(Memory * mem);
+      ~StoreBuffer();
+      uint64_t getLong(int32_t address, bool & error);
+      void putLong(uint64_t value, int32_t address, bool & error);
+      void commit();
+      uint64_t getCommitted();
+};
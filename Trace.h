@@ -0,0 +1,75 @@
+class Machine;
+class PipeReg;
+class Stage;
+
+//first bytes of a trace file
+#define TRACEMAGIC "YESSTRC2"
+#define TRACEMAGICSIZE 8
+//number of records the ring buffer holds (a power of 2)
+#define TRACERINGSIZE 65536
+
+//bits of the flags of a record: the control signals applied at the end
+//of the cycle and whether the memory stage wrote memory. MSTALL is set
+//when E and M stall (and W gets a bubble) for a data cache miss.
+#define TRACE_FSTALL 0x01
+#define TRACE_DSTALL 0x02
+#define TRACE_DBUBBLE 0x04
+#define TRACE_EBUBBLE 0x08
+#define TRACE_MBUBBLE 0x10
+#define TRACE_MEMWRITE 0x20
+#define TRACE_MSTALL 0x40
+
+//what the stages did in one cycle. pc and icode are indexed by stage
+//(FSTAGE ... WSTAGE) and are those of the pipeline registers at the end
+//of the cycle, as the dumps of yess show them: pc[FSTAGE] is the predPC
+//of F (icode[FSTAGE] isn't used) and the pc is NOPC for a bubble. The
+//register writes are those of the writeback stage (dstE and dstM are
+//RNONE if it wrote none) and the memory write is that of the memory
+//stage.
+struct TraceRecord
+{
+   uint64_t cycle;
+   uint64_t pc[NUMSTAGES];
+   uint64_t valE;            //written to dstE
+   uint64_t valM;            //written to dstM
+   uint64_t memAddr;
+   uint64_t memValue;
+   uint8_t icode[NUMSTAGES];
+   uint8_t flags;
+   uint8_t dstE;
+   uint8_t dstM;
+};
+
+//header of a trace file; the register file is the one the first
+//record starts from
+struct TraceHeader
+{
+   char magic[TRACEMAGICSIZE];
+   uint32_t recordSize;      //sizeof(TraceRecord)
+   uint32_t unused;
+   uint64_t reg[REGSIZE];
+};
+
+//writes a binary trace of the pipeline: every cycle, Simulate calls
+//record before the clock rises and finish after, which puts the record
+//in a ring buffer, and a thread of the Trace writes the records in the
+//buffer to the trace file
+class Trace
+{
+   private:
+      Machine * machine;
+      std::ofstream file;
+      TraceRecord * ring;            //allocated by open
+      std::atomic<uint64_t> head;    //number of records put in ring
+      std::atomic<uint64_t> tail;    //number of records written to file
+      std::atomic<bool> done;        //true when no more records will come
+      std::thread writer;
+      void drain();
+   public:
+      Trace(Machine * machine);
+      ~Trace();
+      bool open(const char * fileName);
+      void record(int32_t cycle, PipeReg ** pregs, Stage ** stages);
+      void finish(PipeReg ** pregs);
+      bool close();
+};
@@ -1,8 +1,13 @@
+class RegisterFile;
+
 //class to perform the combinational logic of
 //the Fetch stage
 class WritebackStage: public Stage
 {
    private:
+      RegisterFile * regField;
+   public:
+      WritebackStage(RegisterFile * regField);
       bool doClockLow(PipeReg ** pregs, Stage ** stages);
       void doClockHigh(PipeReg ** pregs);
 
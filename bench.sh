@@ -0,0 +1,216 @@
+#!/bin/bash
+#
+# Measures how fast the simulator runs: each workload is simulated with
+# yess -bench, which discards the dumps and reports the cycles and
+# instructions simulated and the time spent loading, simulating and
+# formatting the dumps. The best of BENCH_REPEAT runs of each workload
+# is kept.
+#
+# Usage: ./bench.sh [yess] [-save | -sample]
+#    yess      the simulator to measure (./yess-opt, built by make bench,
+#              if it exists, otherwise ./yess)
+#    -save     also write the results to bench.baseline
+#    -sample   instead of timing the workloads, compare the cycles that
+#              yess -sample $SAMPLE_SKIP $SAMPLE_WARMUP $SAMPLE_WINDOW
+#              estimates for each one with the cycles of a full run
+#
+# Without -save, the results are compared with bench.baseline (if there
+# is one) and a workload whose cycles per second dropped by more than
+# BENCH_TOLERANCE percent is flagged as a regression; the script then
+# exits with status 1.
+#
+# The workloads are the .ys programs in this directory, which yess
+# assembles itself (or the .yo with the same name if there is no .ys),
+# and two synthetic kernels, a loop and
+# a recursion, whose size is multiplied by BENCH_SCALE. The kernels are
+# dumped every 10000 cycles; the other workloads every cycle.
+
+BENCH_SCALE=${BENCH_SCALE:-1}
+BENCH_REPEAT=${BENCH_REPEAT:-3}
+BENCH_TOLERANCE=${BENCH_TOLERANCE:-10}
+SAMPLE_SKIP=${SAMPLE_SKIP:-1000}
+SAMPLE_WARMUP=${SAMPLE_WARMUP:-50}
+SAMPLE_WINDOW=${SAMPLE_WINDOW:-100}
+#runs shorter than this many seconds are too noisy to compare
+minSeconds=0.001
+
+yess=""
+save=0
+sample=0
+for arg in "$@"
+do
+   if [ "$arg" == "-save" ]; then save=1
+   elif [ "$arg" == "-sample" ]; then sample=1
+   else yess=$arg; fi
+done
+if [ -z "$yess" ]; then
+   if [ -x ./yess-opt ]; then yess=./yess-opt; else yess=./yess; fi
+fi
+
+workloads=( fiboloop insertBST minBST addlist minlist powers absVal asumr )
+dir=Bench
+rm -f -r $dir
+mkdir $dir
+
+# quad <value>
+# outputs the 8 bytes of value in hex, least significant byte first
+quad()
+{
+   local hex=$(printf "%016x" $1)
+   local i
+   for i in 14 12 10 8 6 4 2 0
+   do
+      printf "%s" ${hex:$i:2}
+   done
+}
+
+# line <address> <bytes> <instruction>
+# outputs a line of a .yo file
+line()
+{
+   printf "0x%03x: %-20s | %s\n" $1 $2 "$3"
+}
+
+# loop kernel: a loop of a load, an add, a store and a conditional jump
+loopKernel()
+{
+   local n=$((200000 * BENCH_SCALE))
+   line 0x000 30f1$(quad $n) "irmovq $n, %rcx"
+   line 0x00a 30f2$(quad 1) "irmovq \$1, %rdx"
+   line 0x014 6300 "xorq %rax, %rax"
+   line 0x016 503f$(quad 0x800) "loop: mrmovq 0x800, %rbx"
+   line 0x020 6010 "addq %rcx, %rax"
+   line 0x022 400f$(quad 0x800) "rmmovq %rax, 0x800"
+   line 0x02c 6121 "subq %rdx, %rcx"
+   line 0x02e 74$(quad 0x016) "jne loop"
+   line 0x037 00 "halt"
+}
+
+# recursion kernel: calls a recursive sum 100 levels deep over and over
+recursionKernel()
+{
+   local n=$((1000 * BENCH_SCALE))
+   line 0x000 30f4$(quad 0x1000) "irmovq stack, %rsp"
+   line 0x00a 30f5$(quad $n) "irmovq $n, %rbp"
+   line 0x014 30f2$(quad 1) "irmovq \$1, %rdx"
+   line 0x01e 30f7$(quad 100) "outer: irmovq \$100, %rdi"
+   line 0x028 80$(quad 0x040) "call rsum"
+   line 0x031 6125 "subq %rdx, %rbp"
+   line 0x033 74$(quad 0x01e) "jne outer"
+   line 0x03c 00 "halt"
+   line 0x040 6300 "rsum: xorq %rax, %rax"
+   line 0x042 6277 "andq %rdi, %rdi"
+   line 0x044 73$(quad 0x05e) "je done"
+   line 0x04d a07f "pushq %rdi"
+   line 0x04f 6127 "subq %rdx, %rdi"
+   line 0x051 80$(quad 0x040) "call rsum"
+   line 0x05a b07f "popq %rdi"
+   line 0x05c 6070 "addq %rdi, %rax"
+   line 0x05e 90 "done: ret"
+}
+
+files=()
+options=()
+for w in ${workloads[@]}
+do
+   if [ -e $w.ys ] && cp $w.ys $dir/; then
+      files+=( $dir/$w.ys )
+   elif [ -e $w.yo ]; then
+      files+=( $w.yo )
+   else
+      echo "$w: skipped (no .ys or .yo)"
+      continue
+   fi
+   options+=( "" )
+done
+loopKernel > $dir/loop.yo
+recursionKernel > $dir/recursion.yo
+files+=( $dir/loop.yo $dir/recursion.yo )
+options+=( "-every 10000" "-every 10000" )
+
+if [ $sample -eq 1 ]; then
+   echo "yess -sample $SAMPLE_SKIP $SAMPLE_WARMUP $SAMPLE_WINDOW compared with full runs:"
+   printf "%-12s %10s %10s %10s %8s %8s %10s\n" workload cycles estimate "+/-" \
+      "error %" windows "detailed %"
+   for i in ${!files[@]}
+   do
+      f=${files[$i]}
+      name=$(basename ${f%.*})
+      full=$($yess $f -final -bench | grep "^bench:")
+      if [ -z "$full" ]; then
+         echo "$name: not simulated ($f didn't load)"
+         continue
+      fi
+      $yess $f -sample $SAMPLE_SKIP $SAMPLE_WARMUP $SAMPLE_WINDOW | awk -v name=$name -v full="$full" '
+         BEGIN { split(full, b); for (i = 2; i < length(b); i += 2) v[b[i]] = b[i + 1] }
+         /^Sampling/ { detailed = $NF }
+         /^Windows:/ { windows = $2 }
+         /^Estimated CPI:/ { estimate = $7; interval = $9 }
+         END {
+            if (windows == 0) {
+               printf "%-12s %10d %10s %10s %8s %8d %10.1f\n", name, v["cycles"], "-", "-", "-",
+                  0, detailed * 100 / v["cycles"]
+               exit
+            }
+            printf "%-12s %10d %10d %10d %+8.2f %8d %10.1f\n", name, v["cycles"], estimate,
+               interval, (estimate - v["cycles"]) * 100 / v["cycles"], windows,
+               detailed * 100 / v["cycles"]
+         }'
+   done
+   exit 0
+fi
+
+results=$dir/results
+rm -f $results
+printf "%-12s %10s %10s %9s %9s %9s %12s %12s\n" workload cycles instrs \
+   "load ms" "sim ms" "dump ms" "cycles/s" "instrs/s"
+for i in ${!files[@]}
+do
+   f=${files[$i]}
+   name=$(basename ${f%.*})
+   best=""
+   for ((r = 0; r < BENCH_REPEAT; r++))
+   do
+      out=$($yess $f -bench ${options[$i]} | grep "^bench:")
+      if [ -z "$out" ]; then break; fi
+      sim=$(echo "$out" | awk '{ for (i = 2; i < NF; i += 2) if ($i == "simulate") print $(i + 1) }')
+      if [ -z "$best" ] || awk -v a=$sim -v b=$bestSim 'BEGIN { exit !(a < b) }'; then
+         best=$out
+         bestSim=$sim
+      fi
+   done
+   if [ -z "$best" ]; then
+      echo "$name: not simulated ($f didn't load)"
+      continue
+   fi
+   echo "$best" | awk -v name=$name -v results=$results '{
+      for (i = 2; i < NF; i += 2) v[$i] = $(i + 1)
+      printf "%-12s %10d %10d %9.3f %9.3f %9.3f %12d %12d\n", name, v["cycles"],
+         v["instructions"], v["load"] * 1000, v["simulate"] * 1000,
+         v["dump"] * 1000, v["cycles/s"], v["instructions/s"]
+      print name, v["cycles/s"], v["instructions/s"], v["simulate"] > results
+   }'
+done
+
+if [ ! -e $results ]; then exit 0; fi
+if [ $save -eq 1 ]; then
+   cp $results bench.baseline
+   echo "Saved the results to bench.baseline."
+   exit 0
+fi
+if [ ! -e bench.baseline ]; then exit 0; fi
+
+echo " "
+echo "Compared with bench.baseline (regression: cycles/s down more than $BENCH_TOLERANCE%):"
+awk -v tolerance=$BENCH_TOLERANCE -v minSeconds=$minSeconds '
+   NR == FNR { baseline[$1] = $2; next }
+   {
+      if (!($1 in baseline)) { printf "%-12s no baseline\n", $1; next }
+      change = ($2 - baseline[$1]) * 100 / baseline[$1]
+      flag = ""
+      if ($4 < minSeconds) flag = "(too short to compare)"
+      else if (change < -tolerance) { flag = "REGRESSION"; regressions++ }
+      printf "%-12s %12d -> %12d cycles/s %+7.1f%% %s\n", $1, baseline[$1], $2, change, flag
+   }
+   END { if (regressions > 0) { print regressions " regression(s)."; exit 1 } }
+' bench.baseline $results
@@ -0,0 +1,112 @@
+#!/bin/bash
+#
+# Tests the options of the simulator: each test runs yess on a program
+# in Tests with the options of the test and compares the output with
+# the .idump file of the test in Tests. Failed tests are saved in the
+# OptOutputs directory, as run.sh does with Outputs.
+#
+# Each test is name:program:options. A test can use a file written by
+# a test before it (a checkpoint, a listing or a trace); those files
+# are removed at the end. A test whose program is a .trc trace runs
+# yesstrace on it instead of yess. A test whose .idump is empty (one
+# that only writes a file) passes if yess outputs nothing.
+
+rm -f -r OptOutputs
+mkdir OptOutputs
+dir="Tests"
+
+tests=( "ckpt1:ckpt.yo:-checkpoint 4 ckpt.ck"
+        "ckpt2:ckpt.yo:-restore ckpt.ck 12"
+        "ckpt3:ckpt.yo:-restore ckpt.ck 13"
+        "ckpt4:ckpt.yo:-restore missing.ck 4"
+        "ckpt5:ckpt.yo:-checkpoint 0 ckpt.ck"
+        "ckpt6:ckpt.yo:-restore ckpt.ck 12 -final -stats"
+        "ckpt7:cache.yo:-dcache 64:2:16:fifo:5 -predict bimodal -ras 4 -final -stats -checkpoint 40 ckpt2.ck"
+        "ckpt8:cache.yo:-dcache 64:2:16:fifo:5 -predict bimodal -ras 4 -final -stats -restore ckpt2.ck 120"
+        "ckpt9:cache.yo:-dcache 64:2:16:lru:5 -predict bimodal -ras 4 -restore ckpt2.ck 120"
+        "ras1:ras.yo:-final -stats"
+        "ras2:ras.yo:-ras 4 -final -stats"
+        "ras3:ras.yo:-predict btfn -ras 4 -final -stats"
+        "ras4:ras.yo:-predict bimodal -ras 4 -final -stats"
+        "ras5:ras.yo:-predict gshare -ras 4 -final -stats"
+        "ras6:ras.yo:-predict foo"
+        "ras7:ras.yo:-ras 2000"
+        "jump1:jump.yo:-predict btfn -final -stats"
+        "jump2:jump.yo:-final -stats"
+        "cache1:cache.yo:-icache 64:1:16:lru:3 -dcache 64:2:16:fifo:5 -final -stats"
+        "cache2:cache.yo:-dcache 256:2:16:lru:5 -final -stats"
+        "cache3:cache.yo:-icache 128:4:16:random:2 -dcache 64:2:16:random:4 -final -stats"
+        "cache4:cache.yo:-dcache 100:2:16:lru:5"
+        "cache5:cache.yo:-icache 64:2:16:mru:5"
+        "cache6:cache.yo:-dcache 4096:0x1000000000000000:16:lru:5"
+        "cache7:cache.yo:-dcache 4096:2:16:lru:0x80000000"
+        "cache8:cache.yo:-dcache 4096:2:16:lru:0x100000005"
+        "smc1:smc.yo:-functional"
+        "smc2:smc.yo:-functional -translate"
+        "cores1:cores.yo:-cores 2 -quantum 10 -final"
+        "cores2:cores.yo:-cores 2 -quantum 25 -final"
+        "cores3:cores.yo:-cores 0"
+        "cores4:cores.yo:-cores 65"
+        "cores5:cores.yo:-quantum 0"
+        "trace1:ras.yo:-ras 4 -trace Tests/trace.trc -final"
+        "trace2:trace.trc:"
+        "trace3:trace.trc:-from 10 -to 12"
+        "trace4:trace.trc:-pc 040 -stage D"
+        "trace5:trace.trc:-writes"
+        "asm1:asm.ys:-final"
+        "asm2:asm.ys:-listing Tests/asmlist.yo"
+        "asm3:asmlist.yo:-final"
+        "asmerr1:asmerr1.ys:-final"
+        "asmerr2:asmerr2.ys:-final"
+        "asmerr3:asmerr3.ys:-final"
+        "asmerr4:asmerr4.ys:-final"
+        "asmerr5:asmerr5.ys:-final"
+        "asmerr6:asmerr6.ys:-final"
+        "asmerr7:asmerr7.ys:-final"
+        "asmerr8:asmerr8.ys:-mem 0x2000 -listing asmerr8.yo -final"
+      )
+scratch=( ckpt.ck ckpt2.ck Tests/trace.trc Tests/asmlist.yo asmerr8.yo )
+
+numTests=0
+numPasses=0
+
+for atest in "${tests[@]}"
+do
+   name=${atest%%:*}
+   rest=${atest#*:}
+   infile="$dir/${rest%%:*}"
+   options=${rest#*:}
+   studoutfile="$name.sdump"
+   instoutfile="$dir/$name.idump"
+   program=./yess
+   if [[ $infile == *.trc ]]; then program=./yesstrace; fi
+   rm -f $studoutfile
+   $program $infile $options > $studoutfile
+   rm -f diffs
+   diff $instoutfile $studoutfile > diffs
+   if [ ! -e $studoutfile ] || [ -s diffs ] || 
+      ([ ! -s $studoutfile ] && [ -s $instoutfile ]); then
+      cp $instoutfile OptOutputs/
+      mv $studoutfile OptOutputs/
+      echo "Testing $name ($infile $options) ... failed"
+      cat diffs
+   else
+      rm -f $studoutfile
+      echo "Testing $name ($infile $options) ... passed"
+      numPasses=$(($numPasses+1))
+   fi
+   rm -f diffs
+   numTests=$(($numTests+1))
+done
+rm -f ${scratch[@]}
+echo " "
+echo "$numPasses passed out of $numTests tests."
+
+if [ $numPasses -ne $numTests ]; then
+   echo "Files saved in your OptOutputs directory."
+   echo "Your output files end with a .sdump."
+   echo "Correct output files end with a .idump."
+   exit 1
+else
+   rm -f -r OptOutputs
+fi